@@ -353,6 +353,20 @@ fi
 
 
 
+# GPU backend
+# ~~~~~~~~~~~
+# The host backends (WM_GPU = OMP | TBB) build with WM_COMPILER=Gcc against
+# a plain Thrust include tree instead of the CUDA toolkit
+case "$WM_GPU" in
+OMP | TBB)
+    : ${THRUST_ARCH_PATH:=$WM_THIRD_PARTY_DIR/thrust}
+    : ${TBB_ARCH_PATH:=/usr}
+    export THRUST_ARCH_PATH TBB_ARCH_PATH
+    ;;
+esac
+
+
+
 # Communications library
 # ~~~~~~~~~~~~~~~~~~~~~~
 